@@ -9,12 +9,13 @@
 
 #define SECONDARY_COLOR (LfColor){65, 167, 204, 255} 
 
+#define ERROR_COLOR (LfColor){244, 67, 54, 255}
+
 #define SECONDARY_BACKGROUND_COLOR (LfColor){13, 13, 13, 255}
 
 #define DA_INIT_CAP 64 
 
 #define SMOOTH_SCROLL false
 
-#define MAX_ENTRIES (INPUT_BUF_SIZE / 4)
 #define MAX_DESC_LENGTH (INPUT_BUF_SIZE / 2)
 #define MAX_DATE_LENGTH (INPUT_BUF_SIZE / 16)
\ No newline at end of file
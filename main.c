@@ -7,34 +7,74 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
+#include <math.h>
 
 #include "config.h"
 
 // Enum definitions for GUI tabs, todo filters, and entry priorities
 typedef enum { TAB_DASHBOARD = 0, TAB_NEW_TASK } gui_tab;
-typedef enum { FILTER_ALL = 0, FILTER_IN_PROGRESS, FILTER_COMPLETED, FILTER_LOW, FILTER_MEDIUM, FILTER_HIGH } todo_filter;
+typedef enum { FILTER_ALL = 0, FILTER_IN_PROGRESS, FILTER_COMPLETED, FILTER_LOW, FILTER_MEDIUM, FILTER_HIGH, FILTER_OVERDUE } todo_filter;
 typedef enum { PRIORITY_LOW = 0, PRIORITY_MEDIUM, PRIORITY_HIGH } entry_priority;
+typedef enum { SCHED_DUE = 0, SCHED_REMIND } sched_kind;
 
-// Structure to represent a todo entry
+// Structure to represent a deadline tracked by the scheduler
 typedef struct {
+    time_t at;          // Epoch time of the deadline, 0 if unset
+    int32_t heap_index;    // Position in the scheduler heap, -1 if not scheduled
+    int32_t overdue_index; // Position in the overdue set, -1 if not overdue
+    sched_kind kind;
+    bool fired;
+    struct todo_entry *owner;
+} sched_timer;
+
+// Structure to represent a todo entry
+typedef struct todo_entry {
     bool completed;
     char *desc;
     char *date;
     entry_priority priority;
     bool editing;
     LfInputField edit_input;
+    LfInputField due_input, remind_input;
+    sched_timer due;
+    sched_timer remind;
 } todo_entry;
 
 // Global variables
 static LfFont titlefont, smallfont;
 static todo_filter current_filter;
 static gui_tab current_tab;
-static todo_entry *entries[MAX_ENTRIES];
-static uint32_t numEntries = 0;
+static todo_entry **entries = NULL;
+static uint32_t numEntries = 0, entries_cap = 0;
 static LfTexture removeTexture, backTexture;
 static LfInputField new_task_input;
 static char new_task_input_buf[INPUT_BUF_SIZE];
 static int32_t selected_priority = -1;
+static LfInputField new_task_due_input, new_task_remind_input;
+static char new_task_due_buf[MAX_DATE_LENGTH], new_task_remind_buf[MAX_DATE_LENGTH];
+
+// Input tracking for the main loop, leif's own GLFW callbacks are chained behind these
+static bool input_arrived = false;
+static int32_t inputs_held = 0; // Keys and mouse buttons currently pressed
+static GLFWkeyfun prev_key_callback;
+static GLFWcharfun prev_char_callback;
+static GLFWmousebuttonfun prev_mouse_button_callback;
+static GLFWscrollfun prev_scroll_callback;
+static GLFWcursorposfun prev_cursor_pos_callback;
+
+// Latest epoch time a deadline may have (31.12.9999 23:59:59 UTC), anything beyond is treated as corrupt
+#define SCHED_MAX_EPOCH 253402300799LL
+
+// Scheduler state: binary min-heap of pending deadlines keyed on epoch time
+static sched_timer **sched_heap = NULL;
+static uint32_t sched_len = 0, sched_cap = 0;
+
+// Overdue set: fired due dates, the source of the "OVERDUE" filter. Kept unordered so adding and
+// removing are O(1), and sorted by deadline only when it is shown after a change
+static sched_timer **sched_overdue = NULL;
+static uint32_t sched_overdue_len = 0, sched_overdue_cap = 0;
+static bool sched_overdue_sorted = true;
 
 // Function declarations
 static void toggle_entry_edit_mode(todo_entry *entry);
@@ -43,6 +83,355 @@ static void save_entries_to_json(const char *filename);
 static void load_entries_from_json(const char *filename);
 static void sort_entries_by_priority(todo_entry **entries);
 static void save_entries(void);
+static void sched_insert(sched_timer *timer);
+static void sched_cancel(sched_timer *timer);
+static sched_timer *sched_peek(void);
+static uint32_t sched_fire_expired(time_t now);
+static void schedule_entry(todo_entry *entry, time_t now);
+
+// Swap two heap slots and keep their back-references in sync
+static void sched_swap(uint32_t a, uint32_t b)
+{
+    sched_timer *tmp = sched_heap[a];
+    sched_heap[a] = sched_heap[b];
+    sched_heap[b] = tmp;
+    sched_heap[a]->heap_index = a;
+    sched_heap[b]->heap_index = b;
+}
+
+static void sched_sift_up(uint32_t i)
+{
+    while (i > 0)
+    {
+        uint32_t parent = (i - 1) / 2;
+        if (sched_heap[parent]->at <= sched_heap[i]->at)
+            break;
+        sched_swap(i, parent);
+        i = parent;
+    }
+}
+
+static void sched_sift_down(uint32_t i)
+{
+    for (;;)
+    {
+        uint32_t left = i * 2 + 1, right = left + 1, smallest = i;
+        if (left < sched_len && sched_heap[left]->at < sched_heap[smallest]->at)
+            smallest = left;
+        if (right < sched_len && sched_heap[right]->at < sched_heap[smallest]->at)
+            smallest = right;
+        if (smallest == i)
+            break;
+        sched_swap(i, smallest);
+        i = smallest;
+    }
+}
+
+// Function to make room for one more timer in a scheduler array, growing it geometrically
+static bool sched_reserve(sched_timer ***timers, uint32_t len, uint32_t *cap)
+{
+    if (len < *cap)
+        return true;
+
+    uint32_t new_cap = *cap ? *cap * 2 : DA_INIT_CAP;
+    sched_timer **temp = realloc(*timers, new_cap * sizeof(**timers));
+    if (temp == NULL)
+    {
+        printf("Memory allocation failed\n");
+        return false;
+    }
+    *timers = temp;
+    *cap = new_cap;
+    return true;
+}
+
+// Function to mark a due date as fired and add it to the overdue set, O(1)
+static void sched_overdue_add(sched_timer *timer)
+{
+    timer->fired = true;
+    if (timer->overdue_index != -1 || !sched_reserve(&sched_overdue, sched_overdue_len, &sched_overdue_cap))
+        return;
+
+    timer->overdue_index = sched_overdue_len;
+    sched_overdue[sched_overdue_len++] = timer;
+    sched_overdue_sorted = false;
+}
+
+// Function to drop a due date from the overdue set, O(1)
+static void sched_overdue_remove(sched_timer *timer)
+{
+    if (timer->overdue_index == -1)
+        return;
+
+    // Move the last slot into the hole
+    uint32_t i = timer->overdue_index;
+    sched_overdue_len--;
+    if (i != sched_overdue_len)
+    {
+        sched_overdue[i] = sched_overdue[sched_overdue_len];
+        sched_overdue[i]->overdue_index = i;
+        sched_overdue_sorted = false;
+    }
+    timer->overdue_index = -1;
+}
+
+// Comparison function for sorting the overdue set by deadline
+static int compare_overdue_deadline(const void *a, const void *b)
+{
+    const sched_timer *timer_a = *(sched_timer *const *)a;
+    const sched_timer *timer_b = *(sched_timer *const *)b;
+    return (timer_a->at > timer_b->at) - (timer_a->at < timer_b->at);
+}
+
+// Function to order the overdue set by deadline, only does work after the set has changed
+static void sched_overdue_sort(void)
+{
+    if (sched_overdue_sorted)
+        return;
+    qsort(sched_overdue, sched_overdue_len, sizeof(*sched_overdue), compare_overdue_deadline);
+    for (uint32_t i = 0; i < sched_overdue_len; i++)
+        sched_overdue[i]->overdue_index = i;
+    sched_overdue_sorted = true;
+}
+
+// Function to fire a single deadline, due dates become overdue
+static void sched_fire(sched_timer *timer)
+{
+    if (timer->kind == SCHED_DUE)
+        sched_overdue_add(timer);
+    else
+        timer->fired = true;
+}
+
+// Function to add a deadline to the scheduler, O(log N)
+static void sched_insert(sched_timer *timer)
+{
+    if (!timer->at || timer->heap_index != -1)
+        return;
+
+    if (!sched_reserve(&sched_heap, sched_len, &sched_cap))
+        return;
+
+    timer->heap_index = sched_len;
+    sched_heap[sched_len++] = timer;
+    sched_sift_up(timer->heap_index);
+}
+
+// Function to remove a pending deadline from the heap, O(log N)
+static void sched_heap_remove(sched_timer *timer)
+{
+    if (timer->heap_index == -1)
+        return;
+
+    // Move the last slot into the hole and restore the heap order
+    uint32_t i = timer->heap_index;
+    sched_len--;
+    if (i != sched_len)
+    {
+        sched_heap[i] = sched_heap[sched_len];
+        sched_heap[i]->heap_index = i;
+        sched_sift_up(i);
+        sched_sift_down(i);
+    }
+    timer->heap_index = -1;
+}
+
+// Function to drop a deadline from the scheduler, whether pending or already fired
+static void sched_cancel(sched_timer *timer)
+{
+    if (timer->heap_index != -1)
+        sched_heap_remove(timer);
+    else
+        sched_overdue_remove(timer);
+    timer->fired = false;
+}
+
+// Function to get the earliest pending deadline, O(1)
+static sched_timer *sched_peek(void)
+{
+    return sched_len ? sched_heap[0] : NULL;
+}
+
+// Function to fire every deadline that has passed, returns the number of reminders fired
+static uint32_t sched_fire_expired(time_t now)
+{
+    uint32_t reminders = 0;
+    sched_timer *timer;
+    while ((timer = sched_peek()) != NULL && timer->at <= now)
+    {
+        sched_heap_remove(timer);
+        sched_fire(timer);
+        if (timer->kind == SCHED_REMIND)
+            reminders++;
+    }
+    return reminders;
+}
+
+// Function to arm a deadline, ones already past count as fired without ever entering the heap
+static void sched_arm(sched_timer *timer, time_t now)
+{
+    if (!timer->at)
+        return;
+    if (timer->at <= now)
+        sched_fire(timer);
+    else
+        sched_insert(timer);
+}
+
+// Function to (re)arm the deadlines of an entry, completed entries stay unscheduled
+static void schedule_entry(todo_entry *entry, time_t now)
+{
+    sched_cancel(&entry->due);
+    sched_cancel(&entry->remind);
+    if (entry->completed)
+        return;
+    sched_arm(&entry->due, now);
+    sched_arm(&entry->remind, now);
+}
+
+// Function to set up the deadlines of a freshly created entry
+static void init_entry_schedule(todo_entry *entry, time_t due, time_t remind, time_t now)
+{
+    entry->due = (sched_timer){.at = due, .heap_index = -1, .overdue_index = -1, .kind = SCHED_DUE, .owner = entry};
+    entry->remind = (sched_timer){.at = remind, .heap_index = -1, .overdue_index = -1, .kind = SCHED_REMIND, .owner = entry};
+    schedule_entry(entry, now);
+}
+
+// Function to parse a "dd.mm.yyyy hh:mm" string (comma optional), an empty string yields 0
+static bool parse_datetime(const char *str, time_t *out)
+{
+    *out = 0;
+    if (!strlen(str))
+        return true;
+
+    int day, month, year, hour, minute, consumed = 0;
+    if (sscanf(str, "%d.%d.%d%*[ ,]%d:%d %n", &day, &month, &year, &hour, &minute, &consumed) != 5 || str[consumed] != '\0')
+        return false;
+    // Keep the same range json_to_datetime accepts, so a saved date survives a reload
+    if (year > 9999 || month < 1 || month > 12 || hour < 0 || hour > 23 || minute < 0 || minute > 59)
+        return false;
+
+    struct tm tm = {
+        .tm_mday = day,
+        .tm_mon = month - 1,
+        .tm_year = year - 1900,
+        .tm_hour = hour,
+        .tm_min = minute,
+        .tm_isdst = -1
+    };
+    time_t t = mktime(&tm);
+
+    // mktime normalizes out-of-range days (31.02 -> 03.03), reject those
+    if (t <= 0 || t > SCHED_MAX_EPOCH || tm.tm_mday != day || tm.tm_mon != month - 1 || tm.tm_year != year - 1900)
+        return false;
+    *out = t;
+    return true;
+}
+
+// Function to read an epoch time from JSON, missing or invalid values yield 0
+static time_t json_to_datetime(const cJSON *item)
+{
+    if (!cJSON_IsNumber(item))
+        return 0;
+    double value = item->valuedouble;
+    if (!isfinite(value) || value <= 0.0 || value > (double)SCHED_MAX_EPOCH)
+        return 0;
+    return (time_t)value;
+}
+
+// Function to count presses and releases, repeats leave the count alone
+static void track_held_input(int action)
+{
+    if (action == GLFW_PRESS)
+        inputs_held++;
+    else if (action == GLFW_RELEASE && inputs_held > 0)
+        inputs_held--;
+}
+
+// Input callbacks that note the wake-up was caused by input, then forward to leif
+static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods)
+{
+    input_arrived = true;
+    track_held_input(action);
+    if (prev_key_callback)
+        prev_key_callback(window, key, scancode, action, mods);
+}
+
+static void char_callback(GLFWwindow *window, unsigned int codepoint)
+{
+    input_arrived = true;
+    if (prev_char_callback)
+        prev_char_callback(window, codepoint);
+}
+
+static void mouse_button_callback(GLFWwindow *window, int button, int action, int mods)
+{
+    input_arrived = true;
+    track_held_input(action);
+    if (prev_mouse_button_callback)
+        prev_mouse_button_callback(window, button, action, mods);
+}
+
+static void scroll_callback(GLFWwindow *window, double xoffset, double yoffset)
+{
+    input_arrived = true;
+    if (prev_scroll_callback)
+        prev_scroll_callback(window, xoffset, yoffset);
+}
+
+static void cursor_pos_callback(GLFWwindow *window, double xpos, double ypos)
+{
+    input_arrived = true;
+    if (prev_cursor_pos_callback)
+        prev_cursor_pos_callback(window, xpos, ypos);
+}
+
+// Function to format an epoch time the same way task dates are shown
+static void format_datetime(time_t t, char *buf, size_t size)
+{
+    strftime(buf, size, "%d.%m.%Y, %H:%M", localtime(&t));
+}
+
+// Function to pick the border of a date/time input, invalid dates are marked red
+static LfColor datetime_border_color(bool valid, bool selected)
+{
+    if (!valid)
+        return ERROR_COLOR;
+    return selected ? LF_WHITE : (LfColor){170, 170, 170, 255};
+}
+
+// Function to fill a date/time edit field from an epoch time, 0 leaves it empty
+static void edit_input_set_datetime(LfInputField *input, time_t t)
+{
+    input->buf[0] = '\0';
+    if (t)
+        format_datetime(t, input->buf, input->buf_size);
+    input->cursor_index = strlen(input->buf);
+}
+
+// Function to set up the edit fields of an entry
+static void init_entry_edit_inputs(todo_entry *entry)
+{
+    entry->edit_input = (LfInputField){
+        .width = 400,
+        .buf = malloc(INPUT_BUF_SIZE),
+        .buf_size = INPUT_BUF_SIZE,
+        .placeholder = "Edit description"
+    };
+    strcpy(entry->edit_input.buf, entry->desc);
+    entry->due_input = (LfInputField){
+        .width = 180,
+        .buf = calloc(MAX_DATE_LENGTH, 1),
+        .buf_size = MAX_DATE_LENGTH,
+        .placeholder = "Due date"
+    };
+    entry->remind_input = (LfInputField){
+        .width = 180,
+        .buf = calloc(MAX_DATE_LENGTH, 1),
+        .buf_size = MAX_DATE_LENGTH,
+        .placeholder = "Reminder"
+    };
+}
 
 // Function to toggle edit mode for an entry
 static void toggle_entry_edit_mode(todo_entry *entry)
@@ -53,6 +442,10 @@ static void toggle_entry_edit_mode(todo_entry *entry)
         // If edit mode is activated, copy the current description to the input buffer
         strcpy(entry->edit_input.buf, entry->desc);
         entry->edit_input.cursor_index = strlen(entry->desc);
+
+        // Copy the due date and reminder as well, unset ones stay empty
+        edit_input_set_datetime(&entry->due_input, entry->due.at);
+        edit_input_set_datetime(&entry->remind_input, entry->remind.at);
     }
 }
 
@@ -72,19 +465,36 @@ static void handle_entry_edit(todo_entry *entry)
         input_props.margin_top = 0.0f;
         lf_push_style_props(input_props);
 
-        // Adjust the width of the input field
-        entry->edit_input.width = WIN_INIT_W - lf_get_ptr_x() - GLOBAL_MARGIN * 2;
+        // Adjust the width of the input field, leaving room for the date fields
+        entry->edit_input.width = WIN_INIT_W - lf_get_ptr_x() - GLOBAL_MARGIN * 2 - (entry->due_input.width + entry->remind_input.width + input_props.padding * 4 + 20.0f);
 
         // Render the input field
         lf_input_text(&entry->edit_input);
         lf_pop_style_props();
 
-        // Handle the completion of editing
-        if (lf_key_went_down(GLFW_KEY_ENTER))
+        // Render the due date and reminder fields, emptying one clears it
+        time_t due, remind;
+        bool due_valid = parse_datetime(entry->due_input.buf, &due);
+        bool remind_valid = parse_datetime(entry->remind_input.buf, &remind);
+        input_props.margin_left = 10.0f;
+        input_props.border_color = datetime_border_color(due_valid, entry->due_input.selected);
+        lf_push_style_props(input_props);
+        lf_input_text(&entry->due_input);
+        lf_pop_style_props();
+        input_props.border_color = datetime_border_color(remind_valid, entry->remind_input.selected);
+        lf_push_style_props(input_props);
+        lf_input_text(&entry->remind_input);
+        lf_pop_style_props();
+
+        // Handle the completion of editing, invalid dates keep the entry in edit mode
+        if (lf_key_went_down(GLFW_KEY_ENTER) && due_valid && remind_valid)
         {
             entry->editing = false;
             free(entry->desc);
             entry->desc = strdup(entry->edit_input.buf);
+            entry->due.at = due;
+            entry->remind.at = remind;
+            schedule_entry(entry, time(NULL)); // Re-arm with the new deadlines
             save_entries(); // Save after editing
         }
         else if (lf_key_went_down(GLFW_KEY_ESCAPE))
@@ -103,6 +513,50 @@ static void handle_entry_edit(todo_entry *entry)
     }
 }
 
+// Function to append an entry, growing the entry storage geometrically
+static bool append_entry(todo_entry *entry)
+{
+    if (numEntries == entries_cap)
+    {
+        uint32_t new_cap = entries_cap ? entries_cap * 2 : DA_INIT_CAP;
+        todo_entry **temp = realloc(entries, new_cap * sizeof(*entries));
+        if (temp == NULL)
+        {
+            printf("Memory allocation failed\n");
+            return false;
+        }
+        entries = temp;
+        entries_cap = new_cap;
+    }
+    entries[numEntries++] = entry;
+    return true;
+}
+
+// Function to free an entry and all of its buffers
+static void free_entry(todo_entry *entry)
+{
+    free(entry->desc);
+    free(entry->date);
+    free(entry->edit_input.buf);
+    free(entry->due_input.buf);
+    free(entry->remind_input.buf);
+    free(entry);
+}
+
+// Function to drop an entry from the list and the scheduler, then free it
+static void remove_entry(todo_entry *entry)
+{
+    sched_cancel(&entry->due);
+    sched_cancel(&entry->remind);
+    uint32_t index = 0;
+    while (entries[index] != entry)
+        index++;
+    for (uint32_t j = index; j < numEntries - 1; j++)
+        entries[j] = entries[j + 1];
+    numEntries--;
+    free_entry(entry);
+}
+
 // Function to save entries to a JSON file
 void save_entries_to_json(const char *filename)
 {
@@ -116,6 +570,8 @@ void save_entries_to_json(const char *filename)
         cJSON_AddStringToObject(entry, "desc", entries[i]->desc);
         cJSON_AddStringToObject(entry, "date", entries[i]->date);
         cJSON_AddNumberToObject(entry, "priority", entries[i]->priority);
+        cJSON_AddNumberToObject(entry, "due", (double)entries[i]->due.at);
+        cJSON_AddNumberToObject(entry, "remind", (double)entries[i]->remind.at);
         cJSON_AddItemToArray(json_entries, entry);
     }
     
@@ -164,9 +620,9 @@ void load_entries_from_json(const char *filename)
     }
 
     // Create entries from the JSON
-    numEntries = cJSON_GetArraySize(json_entries);
-    for (uint32_t i = 0; i < numEntries; i++) {
-        cJSON *json_entry = cJSON_GetArrayItem(json_entries, i);
+    time_t now = time(NULL);
+    cJSON *json_entry;
+    cJSON_ArrayForEach(json_entry, json_entries) {
         todo_entry *entry = malloc(sizeof(todo_entry));
         
         // Fill in the entry data
@@ -176,16 +632,15 @@ void load_entries_from_json(const char *filename)
         entry->priority = cJSON_GetObjectItem(json_entry, "priority")->valueint;
         entry->editing = false;
         
-        // Initialize the edit field
-        entry->edit_input = (LfInputField){
-            .width = 400,
-            .buf = malloc(INPUT_BUF_SIZE),
-            .buf_size = INPUT_BUF_SIZE,
-            .placeholder = "Edit description"
-        };
-        strcpy(entry->edit_input.buf, entry->desc);
+        // Initialize the edit fields
+        init_entry_edit_inputs(entry);
+
+        // Schedule the optional due date and reminder
+        cJSON *due = cJSON_GetObjectItem(json_entry, "due");
+        cJSON *remind = cJSON_GetObjectItem(json_entry, "remind");
+        init_entry_schedule(entry, json_to_datetime(due), json_to_datetime(remind), now);
         
-        entries[i] = entry;
+        append_entry(entry);
     }
 
     // Free memory
@@ -269,8 +724,8 @@ static void rendertopbar() {
 
 // Function to render the filter buttons
 static void renderfilters() {
-    uint32_t numfilters = 6;
-    static const char *filters[] = {"ALL", "IN PROGRESS", "COMPLETED", "LOW", "MEDIUM", "HIGH"};
+    uint32_t numfilters = 7;
+    static const char *filters[] = {"ALL", "IN PROGRESS", "COMPLETED", "LOW", "MEDIUM", "HIGH", "OVERDUE"};
 
     // Set up style properties for filter buttons
     LfUIElementProps props = lf_get_theme().button_props;
@@ -323,8 +778,35 @@ static void renderentries() {
     uint32_t renderedcount = 0;
     float start_x = lf_get_ptr_x();
 
-    for (uint32_t i = 0; i < numEntries; i++) {
-        todo_entry *entry = entries[i];
+    // The overdue filter walks the scheduler's overdue set instead of every entry. Rows are taken
+    // from a snapshot, since completing or editing a row changes the set during the walk
+    static todo_entry **overdue_rows = NULL;
+    static uint32_t overdue_rows_cap = 0;
+    bool overdue_only = (current_filter == FILTER_OVERDUE);
+    uint32_t rowcount = numEntries;
+    if (overdue_only) {
+        if (sched_overdue_len > overdue_rows_cap) {
+            todo_entry **temp = realloc(overdue_rows, sched_overdue_len * sizeof(*overdue_rows));
+            if (temp == NULL) {
+                printf("Memory allocation failed\n");
+                lf_div_end();
+                return;
+            }
+            overdue_rows = temp;
+            overdue_rows_cap = sched_overdue_len;
+        }
+        sched_overdue_sort();
+        for (uint32_t i = 0; i < sched_overdue_len; i++) {
+            overdue_rows[i] = sched_overdue[i]->owner;
+        }
+        rowcount = sched_overdue_len;
+    }
+
+    // Removing and re-sorting are applied after the walk, so entries doesn't change under it
+    todo_entry *removed = NULL;
+    bool resort = false;
+    for (uint32_t i = 0; i < rowcount; i++) {
+        todo_entry *entry = overdue_only ? overdue_rows[i] : entries[i];
         
         // Apply filters
         if (current_filter == FILTER_LOW && entry->priority != PRIORITY_LOW) continue;
@@ -348,8 +830,7 @@ static void renderentries() {
             } else {
                 entry->priority++;
             }
-            sort_entries_by_priority(entries);
-            save_entries(); // Save after changing priority
+            resort = true;
         }
 
         // Render priority indicator
@@ -376,12 +857,8 @@ static void renderentries() {
             props.margin_left = 10.0f;
             lf_push_style_props(props);
             if (lf_image_button(((LfTexture){.id = removeTexture.id, .width = 20, .height = 20})) == LF_CLICKED) {
-                // Remove the entry
-                for (uint32_t j = i; j < numEntries - 1; j++) {
-                    entries[j] = entries[j + 1];
-                }
-                numEntries--;
-                save_entries(); // Save after removing a task
+                // Remove the entry once the row is drawn, it is still used below
+                removed = entry;
             }
             lf_pop_style_props();
         }
@@ -397,6 +874,7 @@ static void renderentries() {
             props.color = lf_color_from_zto((vec4s){0.05f, 0.05f, 0.05f, 1.0f});
             lf_push_style_props(props);
             if (lf_checkbox("", &entry->completed, LF_NO_COLOR, ((LfColor){65, 167, 204, 255})) == LF_CLICKED) {
+                schedule_entry(entry, time(NULL)); // Drop or re-arm deadlines, past ones don't alert again
                 save_entries(); // Save after marking/unmarking a task as completed
             }
             lf_pop_style_props();
@@ -420,8 +898,33 @@ static void renderentries() {
         lf_set_ptr_y_absolute(descprt_y + smallfont.font_size + 5.0f);
         props.text_color = (LfColor){150, 150, 150, 255};
         lf_push_style_props(props);
-        lf_text(entry->date);
+        // Strip the trailing newline so the schedule info stays on the same line
+        char date_text[MAX_DATE_LENGTH];
+        snprintf(date_text, sizeof(date_text), "%.*s", (int)strcspn(entry->date, "\n"), entry->date);
+        lf_text(date_text);
         lf_pop_style_props();
+
+        // Render the due date and reminder next to the date
+        if (entry->due.at) {
+            char due_text[MAX_DATE_LENGTH];
+            strcpy(due_text, "Due ");
+            format_datetime(entry->due.at, due_text + strlen(due_text), sizeof(due_text) - strlen(due_text));
+            props.margin_left = 15.0f;
+            props.text_color = entry->due.fired ? ERROR_COLOR : (LfColor){150, 150, 150, 255};
+            lf_push_style_props(props);
+            lf_text(due_text);
+            lf_pop_style_props();
+        }
+        if (entry->remind.at) {
+            char remind_text[MAX_DATE_LENGTH];
+            strcpy(remind_text, "Reminder ");
+            format_datetime(entry->remind.at, remind_text + strlen(remind_text), sizeof(remind_text) - strlen(remind_text));
+            props.margin_left = 15.0f;
+            props.text_color = entry->remind.fired ? SECONDARY_COLOR : (LfColor){150, 150, 150, 255};
+            lf_push_style_props(props);
+            lf_text(remind_text);
+            lf_pop_style_props();
+        }
         lf_pop_font();
 
         lf_next_line();
@@ -434,6 +937,37 @@ static void renderentries() {
         lf_text("There is no task here.");
     }
     lf_div_end();
+
+    if (resort) {
+        sort_entries_by_priority(entries);
+        save_entries(); // Save after changing priority
+    }
+    if (removed) {
+        remove_entry(removed);
+        save_entries(); // Save after removing a task
+    }
+}
+
+// Function to render a labeled date/time input of the new task form
+static void renderdatetimeinput(const char *label, LfInputField *input) {
+    lf_push_font(&smallfont);
+    lf_text(label);
+    lf_pop_font();
+
+    lf_next_line();
+    time_t parsed;
+    bool valid = parse_datetime(input->buf, &parsed);
+    LfUIElementProps props = lf_get_theme().inputfield_props;
+    props.padding = 15.0f;
+    props.border_width = 1.0f;
+    props.color = BACKGROUND_COLOR;
+    props.text_color = LF_WHITE;
+    props.border_color = datetime_border_color(valid, input->selected);
+    props.corner_radius = 2.5f;
+    props.margin_bottom = 10.0f;
+    lf_push_style_props(props);
+    lf_input_text(input);
+    lf_pop_style_props();
 }
 
 // Function to render the new task input form
@@ -474,6 +1008,12 @@ static void rendernewtask() {
 
     lf_next_line();
 
+    // Render due date and reminder inputs
+    renderdatetimeinput("Due date (optional)", &new_task_due_input);
+    lf_next_line();
+    renderdatetimeinput("Reminder (optional)", &new_task_remind_input);
+    lf_next_line();
+
     // Render priority dropdown
     {
         lf_push_font(&smallfont);
@@ -498,7 +1038,11 @@ static void rendernewtask() {
 
     // Render "Add" button
     {
-        bool form_complete = (strlen(new_task_input_buf) && selected_priority != -1);
+        // Parse both dates up front so neither is skipped by short-circuiting
+        time_t due, remind;
+        bool due_valid = parse_datetime(new_task_due_buf, &due);
+        bool remind_valid = parse_datetime(new_task_remind_buf, &remind);
+        bool form_complete = (strlen(new_task_input_buf) && selected_priority != -1 && due_valid && remind_valid);
         const char *text = "Add";
         const float width = 150.0f;
 
@@ -513,7 +1057,7 @@ static void rendernewtask() {
         lf_set_ptr_x_absolute(WIN_INIT_W - (width + props.padding * 2.0f) - GLOBAL_MARGIN);
         lf_set_ptr_y_absolute(WIN_INIT_H - (lf_button_dimension(text).y + props.padding * 2.0f) - GLOBAL_MARGIN);
 
-        if (lf_button_fixed(text, width, -1) == LF_CLICKED || lf_key_went_down(GLFW_KEY_ENTER) && form_complete) {
+        if ((lf_button_fixed(text, width, -1) == LF_CLICKED || lf_key_went_down(GLFW_KEY_ENTER)) && form_complete) {
             // Add new task
             todo_entry *entry = (todo_entry *)malloc(sizeof(*entry));
             entry->priority = selected_priority;
@@ -525,17 +1069,19 @@ static void rendernewtask() {
             
             entry->desc = new_desc;
             entry->editing = false;
-            entry->edit_input = (LfInputField){
-                .width = 400,
-                .buf = malloc(INPUT_BUF_SIZE),
-                .buf_size = INPUT_BUF_SIZE,
-                .placeholder = "Edit description"};
-            strcpy(entry->edit_input.buf, entry->desc);
-
-            entries[numEntries++] = entry;
+            init_entry_edit_inputs(entry);
+            init_entry_schedule(entry, due, remind, time(NULL));
+
+            append_entry(entry);
             memset(new_task_input_buf, 0, INPUT_BUF_SIZE);
             new_task_input.cursor_index = 0;
             lf_input_field_unselect_all(&new_task_input);
+            memset(new_task_due_buf, 0, MAX_DATE_LENGTH);
+            new_task_due_input.cursor_index = 0;
+            lf_input_field_unselect_all(&new_task_due_input);
+            memset(new_task_remind_buf, 0, MAX_DATE_LENGTH);
+            new_task_remind_input.cursor_index = 0;
+            lf_input_field_unselect_all(&new_task_remind_input);
             sort_entries_by_priority(entries);
             save_entries(); // Save after adding a new task
         }
@@ -580,6 +1126,13 @@ int main(int argc, char **argv) {
     // Initialize the Leif GUI library
     lf_init_glfw(WIN_INIT_W, WIN_INIT_H, window);
 
+    // Track input in front of leif's callbacks so the main loop knows when to draw again
+    prev_key_callback = glfwSetKeyCallback(window, key_callback);
+    prev_char_callback = glfwSetCharCallback(window, char_callback);
+    prev_mouse_button_callback = glfwSetMouseButtonCallback(window, mouse_button_callback);
+    prev_scroll_callback = glfwSetScrollCallback(window, scroll_callback);
+    prev_cursor_pos_callback = glfwSetCursorPosCallback(window, cursor_pos_callback);
+
     // Load fonts and textures
     titlefont = lf_load_font("./fonts/inter-bold.ttf", 40);
     smallfont = lf_load_font("./fonts/inter.ttf", 20);
@@ -595,8 +1148,33 @@ int main(int argc, char **argv) {
         .placeholder = "What is there to do?"
     };
 
+    // Initialize the due date and reminder inputs
+    memset(new_task_due_buf, 0, MAX_DATE_LENGTH);
+    new_task_due_input = (LfInputField){
+        .width = 400,
+        .buf = new_task_due_buf,
+        .buf_size = MAX_DATE_LENGTH,
+        .placeholder = "dd.mm.yyyy hh:mm"
+    };
+    memset(new_task_remind_buf, 0, MAX_DATE_LENGTH);
+    new_task_remind_input = (LfInputField){
+        .width = 400,
+        .buf = new_task_remind_buf,
+        .buf_size = MAX_DATE_LENGTH,
+        .placeholder = "dd.mm.yyyy hh:mm"
+    };
+
+    // Deadlines that passed while loading the window count as fired, but don't alert
+    sched_fire_expired(time(NULL));
+
     // Main loop
+    bool follow_up_frame = false;
     while (!glfwWindowShouldClose(window)) {
+        // Fire the deadlines that have passed since the last wake-up
+        if (sched_fire_expired(time(NULL))) {
+            glfwRequestWindowAttention(window);
+        }
+
         // Clear the screen
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
@@ -623,9 +1201,21 @@ int main(int argc, char **argv) {
         // End the GUI frame
         lf_end();
 
-        // Handle events and swap buffers
-        glfwPollEvents();
+        // Swap buffers. A frame after input or held input keeps the loop polling,
+        // otherwise sleep until input arrives or the next deadline is due
         glfwSwapBuffers(window);
+        sched_timer *next = sched_peek();
+        input_arrived = false;
+        if (follow_up_frame || inputs_held > 0) {
+            glfwPollEvents();
+        } else if (next) {
+            double timeout = difftime(next->at, time(NULL));
+            glfwWaitEventsTimeout(timeout > 0.0 ? timeout : 0.0);
+        } else {
+            glfwWaitEvents();
+        }
+        // Input changes state mid-frame, so draw one more frame after the one handling it
+        follow_up_frame = input_arrived;
     }
 
     // Save entries before exiting
@@ -633,11 +1223,11 @@ int main(int argc, char **argv) {
 
     // Cleanup
     for (uint32_t i = 0; i < numEntries; i++) {
-        free(entries[i]->desc);
-        free(entries[i]->date);
-        free(entries[i]->edit_input.buf);
-        free(entries[i]);
+        free_entry(entries[i]);
     }
+    free(entries);
+    free(sched_heap);
+    free(sched_overdue);
 
     lf_free_font(&titlefont);
     lf_free_font(&smallfont);